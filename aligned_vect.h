@@ -21,6 +21,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define NONSTD_ALIGNED_VECT_H
 
 #include "aligned_alloc.h"
+#include "arena.h"
 
 namespace nonstd
 {
@@ -29,13 +30,19 @@ template<class T>
 class aligned_vect
 {
     T* m_data;
+    bool m_owned; //else freed with an arena
 public:
-    aligned_vect () : m_data(NULL) {}
+    aligned_vect () : m_data(NULL), m_owned(false) {}
     aligned_vect (int size)
-        : m_data (static_cast<Vect*>(alloc_blocks(sizeof(T), size))) {}
+        : m_data (static_cast<Vect*>(alloc_blocks(sizeof(T), size))),
+          m_owned(true) {}
     aligned_vect (int size, int block)
-        : m_data (static_cast<Vect*>(alloc_blocks(sizeof(T)*block, size))) {}
-    ~aligned_vect () { if (m_data) free_blocks(m_data); }
+        : m_data (static_cast<Vect*>(alloc_blocks(sizeof(T)*block, size))),
+          m_owned(true) {}
+    aligned_vect (int size, Arena& arena)
+        : m_data (static_cast<T*>(arena.allocate(sizeof(T) * size, 16))),
+          m_owned(false) {}
+    ~aligned_vect () { if (m_owned and m_data) free_blocks(m_data); }
 
     T& operator[] (int i)       { return m_data[i]; }
     T  operator[] (int i) const { return m_data[i]; }
@@ -0,0 +1,56 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_ANALYSIS_H
+#define JENN_ANALYSIS_H
+
+#include "definitions.h"
+#include "todd_coxeter.h"
+#include <stdint.h>
+#include <vector>
+
+//[ structural statistics of coset graphs ]----------
+//  distances are found by breadth-first search from 64 sources at once,
+//  one bit per source in each vertex's word, on a pool of worker threads
+namespace Analysis
+{
+
+const Logging::Logger logger("analyze", Logging::INFO);
+
+struct Distances
+{
+    std::vector<uint64_t> pairs;    //[distance] ordered pairs, incl. (v,v)
+    uint64_t unreachable;           //ordered pairs in different components
+    std::vector<int> eccentricity;  //[vertex] within its component
+    int girth;                      //or 0 if acyclic
+};
+
+//searches from every vertex, or if the graph is vertex-transitive, as an
+//  untruncated coset graph is under its group, from vertex 0 only
+void measure (const ToddCoxeter::Graph& graph, bool transitive,
+              Distances& result, int threads=0);
+
+//prints distance, eccentricity & face statistics; returns an exit status
+int analyze (const ToddCoxeter::Graph& graph, bool transitive,
+             int threads=0);
+
+}
+
+#endif
+
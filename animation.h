@@ -48,8 +48,6 @@ public:
 
     Animate ();
 
-    Mat& twist_theta (float twist); //for stereo
-
     //motion params
     bool stopped;                   //drift control
     bool centered;                  //centering control
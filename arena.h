@@ -0,0 +1,67 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef NONSTD_ARENA_H
+#define NONSTD_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+
+#define ARENA_CHUNK (1<<16) //bytes in the first chunk; later ones double
+#define ARENA_MAX_CHUNK (1<<24)
+
+namespace nonstd
+{
+
+//a monotonic bump allocator: nothing is freed until the whole arena goes.
+//  std::pmr containers built on it never free individually, so a model's
+//  buffers are released as a few chunks, however many vectors they were
+class Arena : public std::pmr::memory_resource
+{
+    struct Chunk { Chunk* prev; size_t size; };
+    Chunk* m_chunks;
+    char *m_pos, *m_end;  //free space in the newest chunk
+    size_t m_next;        //size of the next chunk
+    size_t m_used, m_reserved;
+
+    Arena (const Arena&); //not copyable
+    void operator= (const Arena&);
+
+    void _grow (size_t bytes);
+protected:
+    virtual void* do_allocate (size_t bytes, size_t alignment);
+    virtual void do_deallocate (void*, size_t, size_t) {} //see ~Arena
+    virtual bool do_is_equal (const std::pmr::memory_resource& other)
+        const noexcept { return this == &other; }
+public:
+    Arena (size_t first_chunk = ARENA_CHUNK);
+    virtual ~Arena ();
+
+    //typed arrays, left uninitialized
+    template<class T> T* alloc (size_t num)
+    { return static_cast<T*>(allocate(sizeof(T) * num, alignof(T))); }
+
+    //usage in bytes
+    size_t used () const { return m_used; }
+    size_t reserved () const { return m_reserved; }
+};
+
+}
+
+#endif
@@ -28,6 +28,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "glut_wasm.h"
 #endif
 
+//worker threads, unless built for wasm without pthreads
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define THREADED
+#endif
+
 template<class T> inline T min (T lhs, T rhs) { return (lhs<rhs) ? lhs:rhs; }
 template<class T> inline T max (T lhs, T rhs) { return (lhs>rhs) ? lhs:rhs; }
 
@@ -99,7 +104,7 @@ void title (std::string name);
 const int length = 64;
 const int stride = 2;
 const char* const spaces = "                                                                " + length;
-extern int indentLevel;
+extern thread_local int indentLevel; //as models build on several threads
 inline void indent ();
 inline void outdent ();
 inline const char* indentation () { return spaces - indentLevel * stride; }
@@ -24,6 +24,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "go_game.h"
 #include "linalg.h" //for hopf_phase
 #include "aligned_vect.h"
+#include "raycast.h"
+#include <utility> //for integer_sequence
 
 //[ depth sorting graph drawing ]----------
 namespace Drawings
@@ -47,39 +49,59 @@ const Logging::Logger logger("draw", Logging::INFO);
 #define MAX_DEG 20
 
 class DepthCmp
-{
+{//copied by std::sort, so the values live in the model's arena
 private:
     const int ord;
     float * const values;
 public:
-    DepthCmp (int _ord) : ord(_ord), values(new float[_ord])
+    DepthCmp (int _ord, nonstd::Arena& arena)
+        : ord(_ord), values(arena.alloc<float>(_ord))
     { logger.debug() << "init'ing DeptCmp of size " << ord |0; }
-    //~DepthCmp () { delete[] values; } //this seems to crash
     void update(const nonstd::aligned_vect<Vect>& centers) const
     { for (int i=0; i<ord; ++i) values[i] = centers[i][2]; }
     bool operator () (int v1, int v2) const
     { return values[v1] < values[v2]; }
 };
 
+//style flags that stay fixed through a frame; each combination has its own
+//  compiled drawing path, chosen once per frame, so inner loops test none
+enum Style
+{
+    FANCY     = 1<<0,
+    CURVED    = 1<<1,
+    FACES     = 1<<2, //drawing faces
+    WIREFRAME = 1<<3,
+    CLIPPING  = 1<<4,
+    GLASSY    = 1<<5,
+    BATCHED   = 1<<6, //instancing spheres & tubes
+    NUM_STYLES = 1<<7,
+    DYNAMIC   = NUM_STYLES //the unspecialized path, reading flags as it goes
+};
+
+struct GpuScene; //static buffers for shader-based drawing
+struct OrbitScene; //vertex 0's star & group elements, for symmetric drawing
+
 class Drawing
 {
     //data
+    const size_t graph_bytes;        //arena usage before drawing
     GoGame::GO go;
     ToddCoxeter::Graph &graph;
     const int ord, deg, ord_f;
     float w_bound0, w_bound1, h_bound0, h_bound1;
+    //per-vertex & per-face buffers are allocated in graph.arena()
     const DepthCmp cmp, cmp_f;
-    std::vector<int> sorted;         //depth-sorted vertices
-    std::vector<int> sorted_f;       //depth-sorted faces
+    std::pmr::vector<int> sorted;    //depth-sorted vertices
+    std::pmr::vector<int> sorted_f;  //depth-sorted faces
     typedef nonstd::aligned_vect<Vect> vvector;
     vvector vertices;                //vertex locations
     vvector centers;                 //centers
-    std::vector<float> radii0;       //unscaled radii
-    std::vector<float> scales;       //vertex scales
-    std::vector<float> radii;        //radii
-    std::vector<complex> phases;     //blinkin' hopf phases
-    typedef std::vector<int> Face;
-    const std::vector<Face> &faces;  //faces
+    std::pmr::vector<float> radii0;  //unscaled radii
+    std::pmr::vector<float> scales;  //vertex scales
+    std::pmr::vector<float> radii;   //radii
+    std::pmr::vector<complex> phases; //blinkin' hopf phases
+    typedef ToddCoxeter::Graph::Row Face;
+    const ToddCoxeter::Graph::Table &faces; //faces
     vvector vertices_f, normals;     //face centers & normal vectors
     vvector centers_f;               //projected face centers
     float rad0, sph_rad0, sph_rad;   //standard radius sizes
@@ -108,13 +130,43 @@ class Drawing
 
     std::vector<std::pair<float,int> > ordered_lines;
 
+    //face tessellation cache
+    struct EdgeSamples
+    {
+        typedef std::pmr::polymorphic_allocator<Vect> allocator_type;
+        int level, stamp;            //subdivision level & frame of samples
+        std::pmr::vector<Vect> points; //projected (x,y,z,clamped z), t=0..level
+        EdgeSamples (const allocator_type& alloc = allocator_type())
+            : level(0), stamp(-1), points(alloc) {}
+        EdgeSamples (const EdgeSamples& other, const allocator_type& alloc)
+            : level(other.level), stamp(other.stamp),
+              points(other.points, alloc) {}
+    };
+    ToddCoxeter::Graph::Table face_edges; //[face][side] -> 2*edge + reversed
+    std::pmr::vector<EdgeSamples> edge_samples;
+    std::pmr::vector<int> face_levels; //level of cached face weights
+    std::pmr::vector<int> face_lods;   //subdivisions last chosen per face
+    std::pmr::vector<std::pmr::vector<float> > face_weights; //barycentrics
+    int stamp;                       //current frame, for edge samples
+
     //drawing parameters
     float scale, q_scale;
+    float detail;                    //tessellation, reduced under load
     bool _grid_on;
     bool _drawing_verts, _drawing_edges, _drawing_faces;
     bool _fancy, _hazy, _wireframe, _curved, _high_quality;
+    bool _glassy;                    //faces summed unsorted, else filtered
+    bool _shaded;                    //project in glsl, when available
     bool _clipping;
     bool _update_needed;
+    bool _projected;                 //whether vertices match project
+    bool _nearby;                    //project is near the last, as for eyes
+    bool _lod_held;                  //a second eye, at the first's detail
+    bool _batching;                  //collecting spheres & tubes to instance
+    bool _symmetric;                 //instancing vertex 0's star by symmetry
+    bool _specialized;               //drawing in style-specialized paths
+    GpuScene *gpu;
+    OrbitScene *orbit;
 public:
     int get_params ();
     void set_params (int params);
@@ -126,9 +178,15 @@ public:
     inline void toggle_faces () { _drawing_faces = not _drawing_faces; }
     void toggle_fancy ();
     void toggle_hazy ();
+    void toggle_glassy ();
+    void toggle_shaded ();
+    void toggle_symmetric ();
     void toggle_wireframe ();
     void toggle_curved ();
     void set_quality (bool quality);
+    float get_detail () const { return detail; }
+    void set_detail (float _detail)
+    { detail = _detail; set_quality(_high_quality); }
     void set_scale (float scale);
     float get_tube_rad () { return tube_rad; }
     void set_tube_rad (float rad);
@@ -136,10 +194,19 @@ public:
     void set_coating (float thickness) { coating = thickness; }
     void set_bounds (float w0, float w1, float h0, float h1);
     void set_clipping (bool clipping) { _clipping = clipping; }
+    void set_style (int style);      //sets the flags of a Style mask
+    void set_specialized (bool specialized) { _specialized = specialized; }
+    int num_verts () const { return ord; }
+    int num_edges () const { return graph.num_edges(); }
+    int num_faces () const { return ord_f; }
+    size_t memory_used () { return graph.arena().used(); }
+    const ToddCoxeter::Graph& get_graph () const { return graph; }
+    void memory_report ();
 
     //ctors & dtors
     //Drawing (GoGame::GO *_go);
     Drawing (ToddCoxeter::Graph* g);
+    ~Drawing ();
 
     //wrappers for go board
     void play (int v, int s) { go.play(v,s); }
@@ -148,29 +215,61 @@ public:
 
     //methods
     float get_radius ();
-    void reproject (Mat& theta);
+    //a nearby theta, as for the second stereo eye, repairs the last depth
+    //  order rather than sorting afresh
+    void reproject (Mat& theta, bool nearby = false);
+    bool recenter (const Mat& theta, Mat& jump) const //see Graph::recenter
+    { return graph.recenter(theta[3], jump); }
     void display ();    //using current projection
-    void export_stl (); //using current projection
-    void export_graph ();
+    bool cast (Raycast::Scene& scene); //the fancy style, for ray casting
+    void export_stl (const char* filename="jenn_export.stl"); //current proj.
+    void export_graph (const char* filename="jenn.graph");
+    void export_binary (const char* filename="jenn.jgraph", bool packed=false);
     int select (float x,float y);
 private:
-    int _num_segments (float w, float dist);
+    //drawing paths, specialized to a Style mask S
+    int _style ();
+    typedef void (Drawing::*Pass) (bool orbiting);
+    template<int... S>
+    static const Pass* _passes (std::integer_sequence<int, S...>);
+    template<int S> void _display_pass (bool orbiting);
+
+    template<int S> int _num_segments (float w, float dist);
     int _secant_stride (float w, float rad);
-    int _num_subdivs (float w, int Nfaces);
-    void _draw_bulb     (float* center, float radius);
-    void _draw_sphere   (float* center, float radius, int v);
+    template<int S> int _num_subdivs (float w, int Nfaces);
+    template<int S> void _draw_bulb (float* center, float radius);
+    template<int S> void _draw_sphere (float* center, float radius, int v);
     void _export_sphere (float* center, float radius, int v);
-    void _draw_arc      (Vect& begin, Vect& end, float w);
-    void _draw_arc2     (Vect& begin, Vect& end, float w);
+    template<int S> void _draw_arc  (Vect& begin, Vect& end, float w);
+    template<int S> void _draw_arc2 (Vect& begin, Vect& end, float w);
     void _draw_arc_wide (Vect& begin, Vect& end, float w);
-    void _draw_tube     (Vect& begin, Vect& end,
-                         float r0, float r1, float w, int v0, int v1);
+    template<int S> void _draw_tube (Vect& begin, Vect& end, float r0, float r1,
+                                     float w, int v0, int v1);
     void _export_tube   (Vect& begin, Vect& end,
                          float r0, float r1, float w, int v0, int v1);
-    void _draw_face (int f);
+    template<int S> void _draw_face (int f);
+    bool _begin_glass (bool immediate); //whether faces are summed
+    void _end_glass (bool summed);
+    void _build_face_edges ();
+    const float* _face_weights (int f, int subdivs);
+    const Vect& _edge_sample (int f, int n, int t, int subdivs);
+
+    bool _gpu_active ();
+    void _gpu_build ();
+    void _gpu_colors ();
+    void _gpu_display ();
+    bool _instanced ();
+    void _batch_sphere (float* center, float radius);
+    void _batch_tube (const Vect& begin, const Vect& end, const Vect& tangent,
+                      float r0, float r1, int S, int step);
+    void _draw_batches ();
+    bool _orbiting (int& state);
+    void _build_orbit ();
+    void _draw_orbit (int state);
 
-    void display_vertex (int v);
+    template<int S> void display_vertex (int v);
     void export_vertex (int v);
+    void _project ();
     void sort ();
     inline void update_vertex (int v);
     inline void update_face (int f);
@@ -0,0 +1,65 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_FOCUS_H
+#define JENN_FOCUS_H
+
+#include "definitions.h"
+#include <cmath>
+#include <vector>
+
+//[ depth-of-field by filtering ]----------
+//  a quick alternative to averaging many tilted renders: one sharp render is
+//  blurred by a circle of confusion read from its depth buffer
+namespace Focus
+{
+
+const Logging::Logger logger("focus", Logging::INFO);
+
+#define FOCUS_TAPS 48       //samples gathered per pixel
+#define FOCUS_RADIUS 16.0f  //largest circle of confusion, in pixels
+
+struct Lens
+{//as tilted by Projector::_set_tilt
+    float aperture;     //largest tilt, in radians
+    float focus;        //depth of the focal plane, in R^3
+    float pixels;       //pixels per unit length in R^3
+};
+
+//circle of confusion radius in pixels, from a depth buffer value;
+//  depth buffers hold clamp_depth(z), mapped from [1,-1] to [0,1]
+inline float confusion (const Lens& lens, float depth)
+{
+    float z = 2.0f * tanf(0.5f * M_PI * (1.0f - 2.0f * depth));
+    return min(FOCUS_RADIUS, lens.aperture * lens.pixels * fabsf(z-lens.focus));
+}
+
+//blurs a viewport of the frame buffer in place, in glsl where available
+void blur (const Lens& lens, int x, int y, int w, int h, bool on_cpu=false);
+
+//the same filter on cpu, for rgb & depth as read from a viewport
+void blur (const Lens& lens, int w, int h,
+           const std::vector<float>& depth,
+           const std::vector<unsigned char>& source,
+           std::vector<unsigned char>& result);
+
+}
+
+#endif
+
@@ -0,0 +1,52 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_GALLERY_H
+#define JENN_GALLERY_H
+
+#include "definitions.h"
+
+//[ batch rendering of every preset model ]----------
+//  models are built on a pool of worker threads, then rendered, captured
+//  and exported one at a time on the gl thread
+namespace Gallery
+{
+
+const Logging::Logger logger("gallery", Logging::INFO);
+
+//writes <name>.png, .stl, .graph & .jgraph files per model into dir,
+//  plus a summary in dir/gallery.txt; returns an exit status
+int run (const char* dir, int threads=0);
+
+//times the current model in every drawing style, through specialized &
+//  dynamic drawing paths, printing a table; returns an exit status
+int benchmark (int frames);
+
+//digests every preset model's graph, geometry, stl export & rendered frame,
+//  to guard refactors: writes them to filename, or if verifying, compares
+//  them to those an earlier build wrote, up to float noise
+int digest (const char* filename, bool verify=false);
+
+//exit status when there's no display to digest on, as ctest counts skipped
+const int SKIPPED = 77;
+
+}
+
+#endif
+
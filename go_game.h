@@ -24,6 +24,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <vector>
 #include <map>
 #include <utility>
+#include <memory>
 
 #include "definitions.h"
 #include "todd_coxeter.h"
@@ -42,9 +43,14 @@ typedef char Color;
 const Color EMPTY = 0, BLACK = 1, WHITE = 2;
 class Diff
 {
-    typedef std::map<int,std::pair<Color,Color> > DiffType;
+    typedef std::pmr::map<int,std::pair<Color,Color> > DiffType;
     DiffType m_diff;
 public:
+    typedef DiffType::allocator_type allocator_type;
+    Diff (const allocator_type& alloc = allocator_type()) : m_diff(alloc) {}
+    Diff (const Diff& other, const allocator_type& alloc)
+        : m_diff(other.m_diff, alloc) {}
+
     void add (int pos, Color old_c, Color new_c)
     { m_diff[pos] = std::make_pair(old_c,new_c); }
 
@@ -55,9 +61,10 @@ public:
 };
 class State
 {
-    std::vector<Color> m_state;
+    std::pmr::vector<Color> m_state;
 public: 
-    State (int ord=0, Color start=0) : m_state(ord, start) {}
+    State (int ord, Color start, nonstd::Arena& arena)
+        : m_state(ord, start, &arena) {}
     void fwd (const Diff& diff);
     void bwd (const Diff& diff);
     Color  operator[] (int pos) const { return m_state[pos]; }
@@ -68,15 +75,14 @@ public:
 class GO
 {
 public:
-    std::vector<int> group;    
-    ToddCoxeter::Graph *graph;
+    //declared first, so the arena holding the rest outlives it
+    std::unique_ptr<ToddCoxeter::Graph> graph;
     State current_state;
     unsigned time;
-    std::vector<Diff> history;
-    std::vector<bool> highlighted;
+    std::pmr::vector<Diff> history;
+    std::pmr::vector<bool> highlighted;
     
     GO (ToddCoxeter::Graph *g);
-    ~GO () { delete graph; }
 
     //status
     Color& state (int v) { return current_state[v]; }
@@ -0,0 +1,121 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_GRAPH_FILE_H
+#define JENN_GRAPH_FILE_H
+
+#include "definitions.h"
+#include "todd_coxeter.h"
+#include <stdint.h>
+
+/** Binary graph files (*.jgraph)
+ *
+ * A file is a 112-byte header followed by a payload of sections.  All
+ * numbers are little-endian; each section starts at a 16-byte aligned
+ * offset from the start of the file, so an uncompressed file can be
+ * mmap'd and its sections used in place.
+ *
+ *   header offset   type       field
+ *     0             char[8]    magic, "JENNGRPH"
+ *     8             uint32     version
+ *    12             uint32     flags
+ *    16             uint32     ord, deg, ord_f
+ *    28             uint32     num_corners, num_letters
+ *    36             uint32     reserved, 0
+ *    40             uint64     size of the unpacked file, header included
+ *    48             uint64     offsets of the sections below, in order
+ *
+ *   section         type       count          contents
+ *   adj_offsets     uint32     ord + 1        CSR row offsets into adj
+ *   adj             int32      ord * deg      neighboring cosets
+ *   face_offsets    uint32     ord_f + 1      CSR row offsets into corners
+ *   corners         int32      num_corners    coset of each face corner
+ *   points          float32    4 * ord        vertex positions in S^3
+ *   normals         float32    4 * ord_f      face normals
+ *   word_offsets    uint32     ord + 1        CSR row offsets into letters
+ *   letters         uint8      num_letters    subgroup generators (indices
+ *                                             into -g) leading from coset 0
+ *
+ * When the PACKED flag is set, everything after the header is a single
+ * zlib stream, which inflates to exactly the layout above (offsets are
+ * still counted from the start of the file, header included).
+ */
+
+namespace GraphFile
+{
+
+const Logging::Logger logger("graph", Logging::INFO);
+
+const char MAGIC[8] = {'J','E','N','N','G','R','P','H'};
+const uint32_t VERSION = 1;
+enum Flags { PACKED = 1 };
+
+struct Header
+{
+    char magic[8];
+    uint32_t version, flags;
+    uint32_t ord, deg, ord_f;
+    uint32_t num_corners, num_letters;
+    uint32_t reserved;
+    uint64_t size;              //of the unpacked file, header included
+    uint64_t adj_offsets, adj, face_offsets, corners,
+             points, normals, word_offsets, letters; //section offsets
+};
+static_assert(sizeof(Header) == 112, "jgraph headers are 112 bytes");
+
+class View
+{//read-only sections of a mapped file, without copying
+    const char* m_base;
+    size_t m_length;
+    std::vector<char> m_unpacked;   //used only for packed files
+    bool m_mapped;
+    template<class T> const T* _at (uint64_t offset) const
+    { return reinterpret_cast<const T*>(m_base + offset); }
+    void _map (const char* filename);
+    void _unmap ();
+    void _unpack ();
+    bool _in_bounds () const;
+public:
+    View (const char* filename);
+    ~View ();
+    bool valid () const { return m_base; }
+
+    const Header& header () const { return *_at<Header>(0); }
+    const uint32_t* adj_offsets () const
+    { return _at<uint32_t>(header().adj_offsets); }
+    const int32_t* adj () const { return _at<int32_t>(header().adj); }
+    const uint32_t* face_offsets () const
+    { return _at<uint32_t>(header().face_offsets); }
+    const int32_t* corners () const { return _at<int32_t>(header().corners); }
+    const float* points () const { return _at<float>(header().points); }
+    const float* normals () const { return _at<float>(header().normals); }
+    const uint32_t* word_offsets () const
+    { return _at<uint32_t>(header().word_offsets); }
+    const uint8_t* letters () const { return _at<uint8_t>(header().letters); }
+};
+
+bool packing_available ();
+void save (const ToddCoxeter::Graph& graph, const char* filename,
+           bool packed=false);
+ToddCoxeter::Graph* load (const char* filename);
+
+}
+
+#endif
+
@@ -24,6 +24,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <complex>
 #include <vector>
 #include <cstdlib>
+#include <stdint.h> //for int16_t
 
 typedef std::complex<float> complex;
 
@@ -149,6 +150,23 @@ inline void vect_isadd (Vect&a, float s, const Vect& b)
     for (int i=0; i<4; ++i) { a[i] += b[i] * s; }
 }
 
+//16-bit normalized storage for unit vectors, accurate to ~3e-5
+struct PackedVect
+{
+    int16_t data[4];
+};
+inline void pack_vect (const Vect& a, PackedVect& b)
+{
+    for (int i=0; i<4; ++i) {
+        float x = a[i] < -1.0f ? -1.0f : (a[i] > 1.0f ? 1.0f : a[i]);
+        b.data[i] = static_cast<int16_t>(lrintf(32767.0f * x));
+    }
+}
+inline void unpack_vect (const PackedVect& a, Vect& b)
+{
+    for (int i=0; i<4; ++i) b[i] = a.data[i] * (1.0f / 32767.0f);
+}
+
 void make_ortho (Mat &M);
 void make_asym (Mat &M);
 void mat_iscale (Mat &a, float t);
@@ -161,6 +179,7 @@ void mat_conj (const Mat &a, const Mat &b, Mat &c);
 void mat_copy (const Mat &a, Mat &b);
 void vect_mult (const Mat &a, const Vect &b, Vect &c);
 void vect_imul (const Mat &a, Vect &b);
+void vect_mult_many (const Mat &a, const Vect *b, Vect *c, int n);
 void mat_zero (Mat &a);
 void mat_identity (Mat &a);
 void mat_inverse (const Mat &a, Mat &b);
@@ -188,7 +207,7 @@ void build_geom (const int *coxeter_utriang,
                  const Vect& weights,
                  std::vector<Mat>& gen_reps,
                  Vect &origin);
-complex hopf_phase (Vect &e);
+complex hopf_phase (const Vect &e);
 
 #endif
 
@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "definitions.h"
 #include "drawing.h"
 #include "animation.h"
+#include "simulation.h"
 #include "projection.h"
 #include "polytopes.h"
 
@@ -33,7 +34,6 @@ const float ZOOM_IN = 1.0f / ZOOM_OUT;
 void finish_buffer ();
 void update_title ();
 void toggle_fullscreen ();
-void drift ();
 void end_pause ();
 void beg_pause (bool redraw = true);
 void toggle_pause ();
@@ -21,6 +21,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define JENN_MENUS_H
 
 #include "definitions.h"
+#include "polytopes.h"
 
 #ifdef CYGWIN_HACKS
     #define GLUT_STATIC
@@ -90,6 +91,7 @@ protected:
 public:
     void close () { Assert(not managed, "can't close this menu"); delete this; }
     static void clear ();
+    static void hide () { menus_hidden = true; }
     static void display ();
     static bool mouse (int button, int state, int x, int y);
     static void reshape (int w, int h);
@@ -233,9 +235,11 @@ class ModelMenu : public Menu
     static ModelMenu* s_unique_instance;
     const int m_size;
     const int *m_nums, *m_edges, *m_faces, *m_weights;
+    Polytope::Model _model (int N) const;
+    void _prefetch (int N);
 protected:
     virtual void _call (int N);
-    virtual ~ModelMenu () { s_unique_instance = NULL; }
+    virtual ~ModelMenu ();
     ModelMenu (const char* message, int size,
                const int* nums, const int* edges=NULL, const int* faces=NULL,
                const int* weights=NULL);
@@ -246,8 +250,19 @@ public:
                       const int* weights);
     static void open_fam (const char* prefix, int size, const int* nums);
     static void close ();
+    static void ready ();   //called once a selected model is swapped in
 };
 
+//model tables, in family-menu order
+struct ModelTable
+{
+    const char* name;
+    int size;
+    const int *nums, *edges, *faces, *weights;
+};
+extern const ModelTable model_tables[];
+extern const int num_model_tables;
+
 }
 
 #endif
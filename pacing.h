@@ -0,0 +1,82 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_PACING_H
+#define JENN_PACING_H
+
+#include "definitions.h"
+#include "linalg.h"
+
+//[ frame scheduling ]----------
+//  frames are drawn on glut timers at a target rate, and only once the view
+//  has visibly moved or input asks; a quiescent view sleeps in glut's main
+//  loop, polling on a slow timer, rather than spinning an idle callback
+namespace Pacing
+{
+
+const Logging::Logger logger("pace", Logging::INFO);
+
+#define FRAME_RATE 60.0f    //default target, in frames per second
+#define QUIET_TICKS 30      //ticks without motion before sleeping
+#define SLEEP_TICK 0.1f     //seconds between polls while sleeping
+#define STILL_PIXELS 0.5f   //motion below which frames are skipped
+#define WAKE_PIXELS 2.0f    //motion per sleeping tick that resumes pacing
+#define HOLD_FRAMES 30      //frames between changes of detail
+#define MAX_DROP 3          //halvings of tessellation detail under load
+
+class Pacer
+{
+    float m_budget;             //seconds per frame, at the target rate
+    double m_due;               //when the current tick was due
+    int m_generation;           //of the pending timer; older ones are stale
+    bool m_running;             //else paused, with no timer pending
+    bool m_sleeping;            //polling slowly, having seen no motion
+    bool m_forced;              //input arrived, so draw even if unmoved
+    int m_quiet;                //ticks since a frame was needed
+    Mat m_shown;                //theta as last drawn
+    double m_started;           //when the frame being drawn began, or 0
+    double m_advanced;          //when last simulated, if unthreaded
+    float m_cost, m_spent;      //last & smoothed cost of frames, in seconds
+    int m_drop, m_held;         //detail halvings, & frames since changed
+    void _arm (float delay);
+    float _motion ();
+    void _adapt ();
+public:
+    Pacer (float rate=FRAME_RATE);
+
+    //scheduling
+    void start ();              //on resuming
+    void stop ();               //on pausing, drawing at full detail again,
+                                //  & only polling for background builds
+    void wake ();               //on input, to draw the next tick regardless
+    void tick (int generation); //glut timer callback
+
+    //frame budgets, measured around Projector::display
+    void begin_frame ();
+    void presenting ();         //before swapping, so vsync waits aren't cost
+    void end_frame ();
+};
+
+}
+
+//global instance
+extern Pacing::Pacer* pacer;
+
+#endif
+
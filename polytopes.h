@@ -24,6 +24,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "linalg.h"
 #include <vector>
 
+namespace Drawings { class Drawing; }
+
 namespace Polytope
 {
 
@@ -42,7 +44,25 @@ void view (const int* coxeter,  //upper triang of cox. matrix
    const WordList& e_gens,      //edge words: origin to ___
    const WordList& f_gens,      //generator pairs, or empty word for all faces
    const Vect& weights);        //vertex weights, for positioning center
-void select (int code, int edges=1111, int faces=111111, int weights=1111);
+
+//models by digit pattern, built in the background where threads exist
+struct Model
+{
+    int code, edges, faces, weights;
+    Model (int c=0, int e=1111, int f=111111, int w=1111)
+        : code(c), edges(e), faces(f), weights(w) {}
+    bool operator== (const Model& other) const
+    {
+        return code == other.code and edges == other.edges
+           and faces == other.faces and weights == other.weights;
+    }
+};
+bool select (int code, int edges=1111, int faces=111111, int weights=1111);
+Drawings::Drawing* build (const Model& model); //safe off the gl thread
+void show (Drawings::Drawing* built);           //replaces the current drawing
+bool load (const char* filename);               //from a binary graph file
+void prefetch (const std::vector<Model>& models); //speculative builds
+bool poll ();   //swaps in a finished model; returns whether it did
 
 
 //named polytopes
@@ -22,9 +22,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "definitions.h"
 #include "animation.h"
+#include "simulation.h"
 #include "drawing.h"
 #include "trail.h"
 #include "linalg.h"
+#include <vector>
 
 //stereo params
 #define TWIST_ANGLE 0.06
@@ -47,6 +49,7 @@ class Projector
     bool trailing, trail_paused;
     bool high_quality;
     bool high_contrast, reverse_colors, motion_blur;
+    bool quick_focus;           //filtering depth, rather than tilting
     float aperture_size, depth; //for depth-of-field
     Mat tilt;                   //tilted version
     Mat temp1, temp2, temp3;
@@ -54,15 +57,24 @@ class Projector
     bool _update_needed;
     bool _update_accum;
     void _update();
+
+    //long exposures develop over idle calls, restarting on any update
+    int _exposed;                        //tilt samples averaged so far
+    std::vector<unsigned char> _still;   //as last shown, to see it settle
+    bool _expose (char* output=NULL);    //returns whether still developing
+    bool _settled ();
+    void _focus (char* output=NULL);     //one render, blurred by depth
 public:
     bool paused;
     void update (bool update_accum = true);
+    void interrupt () { if (paused and motion_blur) update(false); } //stills
     void display (char* output=NULL);
     void reset ();
 
 public:
     Projector ()
         : trail(NULL),
+          _exposed(0),
           paused(false)
     { reset(); set_drawing(false); }
 
@@ -74,6 +86,8 @@ public:
     void set_stereo (bool new_val) { in_stereo = new_val; update(); }
     void zoom (float factor) { animator->zoom(factor); update(); }
     int select (int X, int Y);
+    float pixel_scale () const //as published, in pixels per unit of R^3
+    { return (W+h) / simulator->view().vis_rad; }
     bool get_quality () { return high_quality; }
     void toggle_quality ();
     void toggle_trail (Trails::Style style=Trails::RIBBON);
@@ -110,6 +124,7 @@ public:
     void toggle_contrast () { high_contrast = not high_contrast; update(); }
     void toggle_reversed () { reverse_colors = not reverse_colors; update(); }
     void toggle_blur ();
+    void toggle_focus () { quick_focus = not quick_focus; update(false); }
 
     //depth-blur
     void scale_aperture (float scale) { aperture_size *= scale; update(false); }
@@ -127,10 +142,14 @@ public:
     //high-resolution capture
 private:
     bool in_color;
+    bool ray_casting;           //capturing on cpu, without tessellating
     void _capture_little (char* image);
+    bool _cast (char* image, int width, int height, float x_rad, float y_rad);
 public:
     void set_color (bool ic) { in_color = ic; }
-    void capture (unsigned Nwide, unsigned Nhigh);
+    void set_casting (bool rc) { ray_casting = rc; }
+    void capture (unsigned Nwide, unsigned Nhigh,
+                  const char* filename="jenn_capture.png");
 #endif
 
     void set_drawing (bool updating=true);
@@ -0,0 +1,63 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_RAYCAST_H
+#define JENN_RAYCAST_H
+
+#include "definitions.h"
+#include <vector>
+
+//[ ray casting on cpu ]----------
+//  the fancy style's spheres & tubes, already projected to R^3, are hit
+//  analytically rather than tessellated; since the view is orthographic,
+//  rays run along z & primitives are simply binned by screen tiles
+namespace Raycast
+{
+
+const Logging::Logger logger("rcast", Logging::INFO);
+
+#define CAST_TILE 32        //pixels on a side of each binned tile
+#define CAST_SPHERE 10      //center, radius, fg, fl; as instanced
+#define CAST_TUBE 28        //center0, du0, dv0, center1, du1, dv1, fg, fl
+
+struct Scene
+{//as batched by Drawing::cast
+    std::vector<float> spheres;     //CAST_SPHERE floats each
+    std::vector<float> tubes;       //CAST_TUBE floats each, one per segment
+    float background[3];
+    bool hazy;
+    float contrast;                 //tube shading, as in tubes_vert
+};
+
+struct Camera
+{//an orthographic window onto R^3, as set by Projector::_bound_image
+    float x0, x1, y0, y1;
+    int width, height;
+    int samples;                    //per pixel side, for antialiasing
+};
+
+//renders rgb rows bottom-up, as glReadPixels would, on threads workers;
+//  threads=0 uses every core
+void render (const Scene& scene, const Camera& camera,
+             unsigned char* rgb, int threads=0);
+
+}
+
+#endif
+
@@ -0,0 +1,112 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_SHADERS_H
+#define JENN_SHADERS_H
+
+#include "definitions.h"
+#include <vector>
+
+//[ glsl programs & vertex buffers ]----------
+//  these need OpenGL 2.0; the build defines SHADERS where it is available
+namespace Shaders
+{
+
+const Logging::Logger logger("shaders", Logging::INFO);
+
+bool es ();         //whether the current context is gles, as in webgl
+bool available ();  //whether the current context runs glsl
+bool instancing (); //whether it also draws instanced arrays
+
+//fixed-function fog, which es contexts pass to programs as uniforms
+void set_fog (const float* color, float start, float end);
+
+class Program
+{
+    unsigned m_id;
+public:
+    Program (const char* vert_source, const char* frag_source);
+    ~Program ();
+    bool valid () const { return m_id; }
+
+    void bind () const;
+    static void unbind ();
+    int attrib (const char* name) const;
+    void set_matrix (const char* name, const float* rows) const; //row-major
+    void set_vect   (const char* name, const float* value) const;
+    void set_float  (const char* name, float value) const;
+    void set_bool   (const char* name, bool value) const;
+    void set_int    (const char* name, int value) const; //eg texture units
+};
+
+class Buffer
+{//an array of float vertex attributes, in video memory
+    unsigned m_id;
+    const int m_width;  //floats per vertex
+    int m_size;         //number of vertices
+public:
+    Buffer (int width) : m_id(0), m_width(width), m_size(0) {}
+    ~Buffer ();
+    int size () const { return m_size; }
+
+    void load (const std::vector<float>& data, bool stream=false);
+    void attach (int location, int size, int offset=0) const;
+    void attach_instanced (int location, int size, int offset=0) const;
+    static void detach (int location);
+};
+
+//drawing ranges of the attached buffers
+void draw_ranges (unsigned mode, const std::vector<int>& first,
+                                 const std::vector<int>& count);
+void draw_indexed (unsigned mode, const std::vector<unsigned>& indices);
+void draw_instanced (unsigned mode, int count, int instances);
+void draw_indexed_instanced (unsigned mode,
+                             const std::vector<unsigned>& indices,
+                             int instances);
+
+//weighted blended order-independent transparency, after McGuire & Bavoil:
+//  between begin & end, programs on glass_frag sum their fragments into
+//  float targets sharing the depth drawn so far, which end composites over
+//  the viewport, so transparent surfaces needn't be sorted
+bool transparency ();       //whether the context has float targets
+bool begin_transparency (); //false where the targets can't be used
+void end_transparency ();   //unbinds the program summed through
+
+//glsl sources for the stereographic projection S^3 --> R^3
+extern const char * const lines_vert;
+extern const char * const lines_frag;
+extern const char * const bulbs_vert;
+extern const char * const bulbs_frag;
+extern const char * const faces_vert;
+extern const char * const faces_frag;
+extern const char * const spheres_vert;
+extern const char * const spheres_frag;
+extern const char * const tubes_vert;
+extern const char * const stars_vert;
+extern const char * const glass_vert; //faces drawn in immediate mode
+extern const char * const glass_frag; //summing faces_vert or glass_vert
+
+//glsl sources for depth-of-field filtering, mirroring Focus::blur
+extern const char * const focus_vert;
+extern const char * const focus_frag;
+
+}
+
+#endif
+
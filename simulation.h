@@ -0,0 +1,153 @@
+/*
+This file is part of Jenn.
+Copyright 2001-2007 Fritz Obermeyer.
+
+Jenn is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Jenn is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Jenn; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JENN_SIMULATION_H
+#define JENN_SIMULATION_H
+
+#include "definitions.h"
+#include "linalg.h"
+#include <atomic>
+#include <vector>
+#ifdef THREADED
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Simulation
+{
+
+const Logging::Logger logger("sim", Logging::INFO);
+
+//[ triple buffer ]----------
+template<class T>
+class TripleBuffer
+{//single-writer single-reader handoff, without locks
+    //  the writer fills m_slots[m_back], the reader views m_slots[m_front],
+    //  and they trade slots through m_middle, whose FRESH bit is set
+    //  whenever it holds a slot the reader has not seen
+    enum { INDEX = 3, FRESH = 4 };
+    T m_slots[3];
+    std::atomic<int> m_middle;
+    int m_back, m_front;
+public:
+    TripleBuffer () : m_middle(1), m_back(0), m_front(2) {}
+
+    //writer side
+    T& back () { return m_slots[m_back]; }
+    void publish ()
+    {
+        m_back = m_middle.exchange(m_back | FRESH) & INDEX;
+    }
+
+    //reader side
+    bool fresh () const { return m_middle.load() & FRESH; }
+    const T& front ()
+    {
+        if (fresh()) m_front = m_middle.exchange(m_front) & INDEX;
+        return m_slots[m_front];
+    }
+};
+
+//[ input queue ]----------
+double now (); //seconds on a steady clock, as inputs are stamped
+
+struct Input
+{//a control event, applied in the simulation step it happened during
+    enum Kind { DRAG, TRANS_FORCE, ROT_FORCE };
+    Kind kind;
+    float x, y, z;
+    double time;
+    bool shown; //already in a late-latched view
+
+    Input (Kind k, float x_, float y_, float z_=0)
+        : kind(k), x(x_), y(y_), z(z_), time(now()), shown(false) {}
+};
+
+//[ simulation thread ]----------
+struct Snapshot
+{//the part of the animation state that the renderer reads
+    Mat theta;
+    double time;
+    double input; //when the oldest input not yet on screen happened, or 0
+    int jumps;    //recenterings applied, so stale views don't repeat them
+    float vis_rad; //as zoomed, for scales read outside the lock
+
+    void twist_theta (float twist, Mat& result) const; //for stereo
+};
+
+class Simulator
+{//advances the global animator in fixed time steps
+    TripleBuffer<Snapshot> m_snapshots;
+    float m_lag;                    //time not yet simulated
+    double m_clock;                 //when the unsimulated lag began
+    std::atomic<bool> m_paused;
+    std::vector<Input> m_inputs;    //queued, oldest first
+    std::atomic<double> m_unshown;  //oldest input applied but not shown
+    Mat m_jump;                     //a pending recentering, if m_jumping
+    bool m_jumping;
+    int m_jumps;                    //recenterings applied
+    Snapshot m_latched;
+    double m_drawn;                 //input time of the last latched view
+    float m_latency_sum, m_latency_max;
+    int m_latencies;
+#ifdef THREADED
+    std::mutex m_mutex;             //guards the animator
+    std::mutex m_input_mutex;       //guards m_inputs
+    std::atomic<bool> m_running;
+    std::thread m_thread;
+    void _run ();
+#endif
+    bool _apply (double until); //whether the view jumped
+    void _publish ();
+public:
+    Simulator ();
+    ~Simulator ();
+
+    //simulation side, with the animator locked
+    void advance (float dt);
+    void set_paused (bool paused) { m_paused = paused; }
+
+    //render side
+    bool fresh () const { return m_snapshots.fresh(); }
+    const Snapshot& view () { return m_snapshots.front(); }
+    const Snapshot& latch ();   //view(), advanced through queued input to now
+    void presented ();          //after swapping the latched view, for latency
+    void recenter (const Mat& jump, int jumps); //queues a model symmetry,
+                                                //  found from a view's theta
+
+    //input side: queue controls, which need no lock & are never lost,
+    //  or lock the animator while modifying it directly
+    void push (const Input& input);
+    friend class Lock;
+};
+
+class Lock
+{//publishes any changes when released, so input shows in the next frame
+public:
+    Lock ();
+    ~Lock ();
+};
+
+}
+
+//global instance
+extern Simulation::Simulator* simulator;
+
+#endif
+
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "definitions.h"
 #include "linalg.h"
+#include "arena.h"
 #include <vector>
 
 namespace ToddCoxeter
@@ -29,25 +30,100 @@ namespace ToddCoxeter
 
 const Logging::Logger logger("t/c", Logging::INFO);
 
+#define MAX_RANK 5 //highest rank enumerated; only rank 4 has geometry
+#define COMPACT_ORD (1<<16) //default size above which geometry is packed
+#define BALL_ORD (1<<18) //default most group elements enumerated
+
 //cayley coset graph
 typedef std::vector<int> Ring;
 typedef std::vector<int> Word;
 class Graph
 {
+    nonstd::Arena m_arena; //owns every table below, so precedes them
+    bool m_compact;
 public:
+    typedef std::pmr::vector<int> Row;
+    typedef std::pmr::vector<Row> Table;
     int ord, deg, ord_f;
-    std::vector<Word> adj; //[coset][edge]
-    std::vector<Ring> faces; //[face][corner]
-    std::vector<Vect> points;
-    std::vector<Vect> normals;
+    Table adj; //[coset][edge]
+    Table faces; //[face][corner]
+    std::pmr::vector<Vect> points;  //unless compact
+    std::pmr::vector<Vect> normals;
+    std::pmr::vector<PackedVect> packed_points; //if compact
+    std::pmr::vector<PackedVect> packed_normals;
+    Table words; //[coset] gens leading from coset 0
+    std::pmr::vector<Mat> gen_reps; //[gen] actions on S^3, unless loaded
+    Row depths; //[coset] edges from coset 0, if the group was truncated
+    int frontier; //greatest depth, or 0 if the group was enumerated whole
+    Graph () //to be filled by a loader
+        : m_compact(false), ord(0), deg(0), ord_f(0),
+          adj(&m_arena), faces(&m_arena),
+          points(&m_arena), normals(&m_arena),
+          packed_points(&m_arena), packed_normals(&m_arena),
+          words(&m_arena), gen_reps(&m_arena),
+          depths(&m_arena), frontier(0) {}
     Graph (const int *cartan,
            const std::vector<Word>& gens,
            const std::vector<Word>& v_cogens,
            const std::vector<Word>& e_gens,
            const std::vector<Word>& f_gens,
            const Vect& weights);
+    //combinatorics only, without points or normals, for ranks 3..MAX_RANK;
+    //  cartan lists the rank*(rank-1)/2 upper-triangular coxeter entries
+    Graph (int rank,
+           const int *cartan,
+           const std::vector<Word>& gens,
+           const std::vector<Word>& v_cogens,
+           const std::vector<Word>& e_gens,
+           const std::vector<Word>& f_gens);
 
     void save (const char* filename = "jenn.graph");
+    int num_edges () const; //excluding self-loops
+
+    //geometry, unpacked on the fly from compact graphs
+    static int compact_ord; //least ord stored compactly
+    bool compact () const { return m_compact; }
+    Vect point (int v) const
+    {
+        if (not m_compact) return points[v];
+        Vect result; unpack_vect(packed_points[v], result); return result;
+    }
+    Vect normal (int f) const
+    {
+        if (not m_compact) return normals[f];
+        Vect result; unpack_vect(packed_normals[f], result); return result;
+    }
+    void set_geometry (const std::vector<Vect>& points,
+                       const std::vector<Vect>& normals);
+    size_t geometry_bytes () const;
+
+    //the group element taking point(0) to point(v), if gen_reps are known
+    bool symmetry (int v, Mat& result) const;
+
+    //groups too big to enumerate are truncated to a ball about the identity,
+    //  with frontier cosets padded by self-loops; once the coset nearest
+    //  center is past half the frontier, this gives the symmetry moving it
+    //  to coset 0, so views can follow the ball around S^3
+    static int ball_ord; //most group elements enumerated
+    bool recenter (const Vect& center, Mat& result) const;
+
+    //per-model memory, for the graph & whatever draws it
+    nonstd::Arena& arena () { return m_arena; }
+private:
+    template<int N> //group rank, fixing array sizes & relation counts
+    void _enumerate (const int *cartan,
+                     const std::vector<Word>& gens,
+                     const std::vector<Word>& v_cogens,
+                     const std::vector<Word>& e_gens,
+                     const std::vector<Word>& f_gens,
+                     std::vector<Word>& vertex_coset);
+    void _truncate ();
+    void _place_in_tits_cone (const int *cartan,
+                              const std::vector<Word>& vertex_coset,
+                              const std::vector<Word>& gens,
+                              const std::vector<Word>& v_cogens,
+                              const Vect& weights,
+                              std::vector<Vect>& verts);
 };
 
 }
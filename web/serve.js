@@ -0,0 +1,39 @@
+// Serves this directory on http://localhost:8000 (or the port given),
+// cross-origin isolated as threaded wasm builds need for SharedArrayBuffer.
+//   usage: node serve.js [port]
+
+const http = require('http');
+const fs = require('fs');
+const path = require('path');
+
+const root = __dirname;
+const port = Number(process.argv[2]) || 8000;
+const types = {
+  '.html': 'text/html',
+  '.js': 'text/javascript',
+  '.wasm': 'application/wasm',
+  '.ico': 'image/x-icon',
+};
+
+http.createServer((request, response) => {
+  const url = decodeURIComponent(request.url.split('?')[0]);
+  const file = path.join(root, url === '/' ? 'index.html' : url);
+  if (file !== root && !file.startsWith(root + path.sep)) {
+    response.writeHead(403);
+    response.end();
+    return;
+  }
+  fs.readFile(file, (error, data) => {
+    if (error) {
+      response.writeHead(404);
+      response.end();
+      return;
+    }
+    response.writeHead(200, {
+      'Content-Type': types[path.extname(file)] || 'application/octet-stream',
+      'Cross-Origin-Opener-Policy': 'same-origin',
+      'Cross-Origin-Embedder-Policy': 'require-corp',
+    });
+    response.end(data);
+  });
+}).listen(port, () => console.log(`serving ${root} at http://localhost:${port}`));